@@ -0,0 +1,14 @@
+#ifndef HOST_ALLOC_H
+#define HOST_ALLOC_H
+
+#include <stdlib.h>
+
+#define farmalloc(size)	malloc(size)
+#define farfree(block)	free(block)
+
+/* Host heap is not bounded, report all of the conventional memory free. */
+static inline unsigned long farcoreleft() {
+	return 0xa0000UL;
+}
+
+#endif
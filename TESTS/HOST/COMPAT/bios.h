@@ -0,0 +1,14 @@
+#ifndef HOST_BIOS_H
+#define HOST_BIOS_H
+
+#include <time.h>
+
+/* BIOS timer ticks since start of the process, about 18.2 per second. */
+static inline long biostime(int cmd, long newtime) {
+	(void)cmd;
+	(void)newtime;
+
+	return (long)((double)clock() * 18.2065 / CLOCKS_PER_SEC);
+}
+
+#endif
@@ -0,0 +1,20 @@
+#ifndef HOST_CONIO_H
+#define HOST_CONIO_H
+
+#include <dos.h>
+
+static inline int outp(unsigned port, int value) {
+	vga_emulator::out((uint16_t)port, (uint8_t)value);
+	return value;
+}
+
+static inline unsigned outpw(unsigned port, unsigned value) {
+	vga_emulator::out_word((uint16_t)port, (uint16_t)value);
+	return value;
+}
+
+static inline int inp(unsigned port) {
+	return vga_emulator::in((uint16_t)port);
+}
+
+#endif
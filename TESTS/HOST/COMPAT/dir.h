@@ -0,0 +1,6 @@
+#ifndef HOST_DIR_H
+#define HOST_DIR_H
+
+#define MAXPATH	80
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef HOST_DOS_H
+#define HOST_DOS_H
+
+/* Real-mode services on the virtual VGA of TESTS/HOST/VGAEMU.CPP.
+ *
+ * Segments below 10000h address the emulated conventional memory, larger
+ * ones are host pointers shifted right by 4, so that far pointers of
+ * both kinds survive FP_SEG/FP_OFF/MK_FP round trips.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "vgaemu.hpp"
+
+struct WORDREGS {
+	uint16_t ax, bx, cx, dx, si, di, cflag, flags;
+};
+
+struct BYTEREGS {
+	uint8_t al, ah, bl, bh, cl, ch, dl, dh;
+};
+
+union REGS {
+	struct WORDREGS x;
+	struct BYTEREGS h;
+};
+
+struct REGPACK {
+	unsigned long r_ax, r_bx, r_cx, r_dx;
+	unsigned long r_bp, r_si, r_di, r_ds, r_es, r_flags;
+};
+
+static inline void *MK_FP(unsigned long seg, unsigned long off) {
+	if (seg < 0x10000UL)
+		return vga_emulator::get_memory() + (seg << 4) + off;
+
+	return (void *)((seg << 4) + off);
+}
+
+static inline unsigned long host_linear(const volatile void *ptr) {
+	uintptr_t address = (uintptr_t)ptr;
+	uintptr_t memory = (uintptr_t)vga_emulator::get_memory();
+
+	if (address >= memory && address < memory + VGAEMU_MEMORY_SIZE)
+		return (unsigned long)(address - memory);
+
+	return (unsigned long)address;
+}
+
+#define FP_SEG(ptr)	(host_linear(ptr) >> 4)
+#define FP_OFF(ptr)	(host_linear(ptr) & 0x0fUL)
+
+static inline unsigned char peekb(unsigned long seg, unsigned long off) {
+	if (seg < 0x10000UL)
+		return vga_emulator::read((uint32_t)((seg << 4) + off));
+
+	return *(unsigned char *)MK_FP(seg, off);
+}
+
+static inline void pokeb(unsigned long seg, unsigned long off,
+						 unsigned char value) {
+	if (seg < 0x10000UL)
+		vga_emulator::write((uint32_t)((seg << 4) + off), value);
+	else
+		*(unsigned char *)MK_FP(seg, off) = value;
+}
+
+static inline int int86(int number, union REGS *in, union REGS *out) {
+	unsigned long es = 0, bp = 0;
+
+	if (out != in)
+		*out = *in;
+
+	vga_emulator::interrupt((uint8_t)number, &out->x.ax, &out->x.bx,
+							&out->x.cx, &out->x.dx, &es, &bp);
+	return out->x.ax;
+}
+
+static inline void intr(int number, struct REGPACK *regs) {
+	uint16_t ax = (uint16_t)regs->r_ax, bx = (uint16_t)regs->r_bx;
+	uint16_t cx = (uint16_t)regs->r_cx, dx = (uint16_t)regs->r_dx;
+
+	vga_emulator::interrupt((uint8_t)number, &ax, &bx, &cx, &dx,
+							&regs->r_es, &regs->r_bp);
+
+	regs->r_ax = ax;
+	regs->r_bx = bx;
+	regs->r_cx = cx;
+	regs->r_dx = dx;
+}
+
+static inline void outport(int port, int value) {
+	vga_emulator::out_word((uint16_t)port, (uint16_t)value);
+}
+
+static inline void outportb(int port, unsigned char value) {
+	vga_emulator::out((uint16_t)port, value);
+}
+
+static inline unsigned char inportb(int port) {
+	return vga_emulator::in((uint16_t)port);
+}
+
+static inline void delay(unsigned milliseconds) {
+	(void)milliseconds;
+}
+
+static inline void disable() {
+}
+
+static inline void enable() {
+}
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef HOST_H
+#define HOST_H
+
+/* Forced include of host builds, maps Borland C++ extensions used by the
+ * sources to their flat memory model equivalents.
+ */
+
+#include <ctype.h>
+#include <string.h>
+#include <strings.h>
+
+#define far
+#define near
+#define huge
+
+static inline char *strlwr(char *str) {
+	for (char *chr = str; *chr != '\0'; ++chr)
+		*chr = (char)tolower(*chr);
+
+	return str;
+}
+
+static inline char *strupr(char *str) {
+	for (char *chr = str; *chr != '\0'; ++chr)
+		*chr = (char)toupper(*chr);
+
+	return str;
+}
+
+#define stricmp strcasecmp
+
+#endif
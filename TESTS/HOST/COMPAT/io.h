@@ -0,0 +1,6 @@
+#ifndef HOST_IO_H
+#define HOST_IO_H
+
+#include <unistd.h>
+
+#endif
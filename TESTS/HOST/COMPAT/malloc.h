@@ -0,0 +1,6 @@
+#ifndef HOST_MALLOC_H
+#define HOST_MALLOC_H
+
+#include <alloc.h>
+
+#endif
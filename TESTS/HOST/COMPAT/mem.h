@@ -0,0 +1,14 @@
+#ifndef HOST_MEM_H
+#define HOST_MEM_H
+
+#include <string.h>
+#include <dos.h>
+
+static inline void movedata(unsigned long srcseg, unsigned long srcoff,
+							unsigned long destseg, unsigned long destoff,
+							size_t n) {
+	for (size_t i = 0; i < n; ++i)
+		pokeb(destseg, destoff + i, peekb(srcseg, srcoff + i));
+}
+
+#endif